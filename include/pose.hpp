@@ -3,6 +3,9 @@
 #pragma once
 
 #include <fstream>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 #include <Eigen/Dense>
 
@@ -15,6 +18,20 @@ namespace sdr {
     using position_t = Eigen::Matrix<double, 1, 3> ; // 1 * 3 matrix (xyz position)
     using rotation_m_t = Eigen::Matrix<double, 3, 3> ; // 3 * 3 matrix (rot. matrix)
     using quaternion_t = Eigen::Quaternion<double, Eigen::AutoAlign> ; // 4 * 1 matrix
+    using twist_t = Eigen::Matrix<double, 1, 6> ; // 1 * 6 matrix (xyz linear velocity, xyz angular velocity - both local)
+
+    constexpr double default_max_substep_angle = 0.01 ; // radians - max rotation per substep of the adaptive integrator
+
+    enum class integrator_t {
+    /**
+      * @brief integrator_t (enum class) - selectable schemes for integrating a twist over a log entry's time span
+      */
+        euler, // first order, holds the latest twist over the whole span (position updated before orientation)
+        midpoint, // second order, explicit midpoint
+        trapezoidal, // second order, Heun's method (average of slopes at both ends of the span)
+        rk4, // fourth order, Runge-Kutta-Munthe-Kaas on SE(3)
+        adaptive // midpoint substeps, count driven by angular rate magnitude
+    } ;
 
     class Pose {
     /**
@@ -68,6 +85,19 @@ namespace sdr {
               */
             void update_orientation(const double, const double, const double) noexcept(false) ;
 
+            /**
+              * @brief integrate - advances pose over a span of time, with the twist linearly interpolated between the values reported at the start and end of said span
+              * Note: orientation is treated as mapping local to global (global translation = orientation * local translation) and is propagated through the SO(3) exponential map. This differs from update_position (which maps local translation by the transposed orientation) and update_orientation (yaw / pitch / roll matrices), so trajectories from the two paths diverge once there is any rotation
+              * @param const sdr::twist_t& - const reference to twist at start of span (ie. previous log entry)
+              * @param const sdr::twist_t& - const reference to twist at end of span (ie. current log entry)
+              * @param const double - time spanned in seconds
+              * @param const sdr::integrator_t - integration scheme to be applied
+              * @param const double - max rotation (radians) per substep of the adaptive integrator
+              * @param const std::size_t - max number of substeps of the adaptive integrator
+              * @throws sdr::DetailedException - thrown in case of negative time span or invalid adaptive integrator parameters
+              */
+            void integrate(const twist_t&, const twist_t&, const double, const integrator_t, const double = default_max_substep_angle, const std::size_t = 64) noexcept(false) ;
+
             // below are defaulted and deleted methods
             Pose(const Pose&) noexcept = default ; // copy constructor
             Pose& operator=(const Pose&) noexcept = default ; // copy assignment operator
@@ -94,6 +124,14 @@ namespace sdr {
       */
     std::vector<double> velocities_to_deltas(const ::std::vector<double>&, const double) noexcept ;
 
+    /**
+      * @brief to_integrator - converts name of integration scheme (euler, midpoint, trapezoidal, rk4, adaptive) to its enum value
+      * @param const std::string& - const reference to string storing name of integration scheme
+      * @throws sdr::DetailedException - thrown when name does not correlate to any integration scheme
+      * @return sdr::integrator_t - integration scheme correlating to given name
+      */
+    integrator_t to_integrator(const ::std::string&) noexcept(false) ;
+
 } ; // namespace sdr
 
 #endif // POSE_HPP
@@ -0,0 +1,293 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <array>
+#include <utility>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include "detailed_exception.hpp"
+#include "pose.hpp"
+
+/**
+  * @brief Benchmark source file comparing pose integration schemes - trajectory error against time taken per log entry, over a range of log rates
+  * Run with --check to instead verify the integrators (convergence order, closed form poses, error handling), exiting non-zero upon failure
+  * Note: each scheme is fed a known twist sampled at coarser log rates, as sdr would read it from a log file (each entry reporting the twist at the end of its time span). Errors are measured against a reference built independently of sdr::Pose::integrate, as a very fine product of exponentials
+  */
+
+namespace sdr {
+
+    using twist_function_t = twist_t(*)(const double) ; // twist as a function of time
+
+    /**
+      * @brief smooth_twist - smoothly varying twist, typical of a vehicle weaving whilst changing speed
+      * @param const double - time in seconds
+      * @return sdr::twist_t - twist at given time
+      */
+    twist_t smooth_twist(const double time) noexcept
+    {
+        return twist_t{
+            {
+                2.f + 0.5 * std::sin(0.8 * time), 0.2 * std::cos(0.7 * time), 0.1 * std::sin(1.3 * time),
+                0.1 * std::sin(0.9 * time), 0.15 * std::cos(1.1 * time), 0.6 * std::sin(0.5 * time) + 0.3
+            }
+        } ;
+    }
+
+    /**
+      * @brief linear_twist - twist varying linearly in time, so interpolating between log entries is exact and only the integration scheme contributes error
+      * @param const double - time in seconds
+      * @return sdr::twist_t - twist at given time
+      */
+    twist_t linear_twist(const double time) noexcept
+    {
+        return twist_t{
+            {
+                1.f + 0.05 * time, 0.02 * time, -0.1,
+                0.1 - 0.005 * time, 0.01 * time, 0.3 + 0.02 * time
+            }
+        } ;
+    }
+
+    /**
+      * @brief reference_pose - integrates twist as a product of exponentials over many small steps, each step rotating by the twist at its middle (second order, independent of sdr::Pose::integrate)
+      * @param const sdr::twist_function_t - twist as a function of time
+      * @param const double - duration of trajectory in seconds
+      * @param const std::size_t - number of steps to split duration into
+      * @return sdr::Pose - final pose
+      */
+    Pose reference_pose(const twist_function_t twist_at, const double duration, const ::std::size_t steps) noexcept
+    {
+        auto exp_so3 = [](const Eigen::Vector3d& theta) -> Eigen::Matrix3d {
+            const double angle = theta.norm() ;
+            return angle > 0.f ? Eigen::Matrix3d(Eigen::AngleAxisd(angle, theta / angle)) : Eigen::Matrix3d(Eigen::Matrix3d::Identity()) ;
+        } ;
+
+        const double step = duration / static_cast<double>(steps) ;
+        Eigen::Matrix3d orientation = Eigen::Matrix3d::Identity() ;
+        Eigen::Vector3d position = Eigen::Vector3d::Zero() ;
+        for(std::size_t i = 0 ; i < steps ; ++i)
+        {
+            const twist_t twist = twist_at((static_cast<double>(i) + 0.5) * step) ;
+            const Eigen::Vector3d linear = twist.head<3>().transpose() ;
+            const Eigen::Vector3d angular = twist.tail<3>().transpose() ;
+
+            position += orientation * exp_so3(0.5 * step * angular) * linear * step ;
+            orientation = orientation * exp_so3(step * angular) ;
+        }
+
+        return Pose{position.transpose(), quaternion_t{orientation}} ;
+    }
+
+    /**
+      * @brief run_log - integrates twist sampled at given rate
+      * @param const sdr::twist_function_t - twist as a function of time
+      * @param const double - duration of trajectory in seconds
+      * @param const std::size_t - number of entries to split duration into
+      * @param const sdr::integrator_t - integration scheme to be applied
+      * @param const std::size_t - number of timed repetitions (following an untimed warm up)
+      * @return std::pair<sdr::Pose, double> - final pose along with median nanoseconds taken per entry
+      */
+    ::std::pair<Pose, double> run_log(const twist_function_t twist_at, const double duration, const ::std::size_t entries, const integrator_t integrator, const ::std::size_t repetitions) noexcept(false)
+    {
+        const double time = duration / static_cast<double>(entries) ;
+
+        std::vector<twist_t> twists(entries + 1) ; // sampled beforehand so only integration is timed
+        for(std::size_t i = 0 ; i <= entries ; ++i)
+        {
+            twists[i] = twist_at(static_cast<double>(i) * time) ;
+        }
+
+        auto integrate_log = [&]() -> sdr::Pose {
+            sdr::Pose pose ;
+            for(std::size_t i = 1 ; i <= entries ; ++i)
+            {
+                pose.integrate(twists[i - 1], twists[i], time, integrator) ;
+            }
+            return pose ;
+        } ;
+
+        const sdr::Pose pose = integrate_log() ; // warm up
+        std::vector<double> ns_per_entry(repetitions) ;
+        for(double& ns : ns_per_entry)
+        {
+            const auto start = std::chrono::steady_clock::now() ;
+            const sdr::Pose repeated = integrate_log() ;
+            const auto end = std::chrono::steady_clock::now() ;
+
+            asm volatile("" : : "g"(&repeated) : "memory") ; // keeps integration from being optimised away
+            ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / static_cast<double>(entries) ;
+        }
+        std::nth_element(ns_per_entry.begin(), ns_per_entry.begin() + ns_per_entry.size() / 2, ns_per_entry.end()) ;
+
+        return {pose, ns_per_entry[ns_per_entry.size() / 2]} ;
+    }
+
+    /**
+      * @brief self_check - verifies each integrator's order of accuracy on a linearly varying twist, that constant twists reach their closed form pose, that adaptive with a single substep equals midpoint (and beats it once substepping), and that invalid input throws
+      * @return bool - whether every check passed
+      */
+    bool self_check() noexcept
+    {
+        bool passed = true ;
+        auto check = [&](const std::string& name, const bool condition) -> void {
+            std::cout << (condition ? "PASS: " : "FAIL: ") << name << '\n' ;
+            passed = passed && condition ;
+        } ;
+        auto throws = [](const std::function<void()>& call) -> bool {
+            try {
+                call() ;
+            }
+            catch(const sdr::DetailedException&)
+            {
+                return true ;
+            }
+            return false ;
+        } ;
+
+        const std::array<std::pair<std::string, sdr::integrator_t>, 4> orders{{
+            {"euler", sdr::integrator_t::euler},
+            {"midpoint", sdr::integrator_t::midpoint},
+            {"trapezoidal", sdr::integrator_t::trapezoidal},
+            {"rk4", sdr::integrator_t::rk4}
+        }} ;
+        const std::array<double, 4> expected_orders{1.f, 2.f, 2.f, 4.f} ;
+
+        /* Convergence order - errors against reference should shrink by 2^order upon halving the time span of each entry */
+        auto steep_twist = [](const double time) -> sdr::twist_t {
+            return sdr::twist_t{{1.f + 0.5 * time, 0.3 * time, -0.2, 0.4 + 0.3 * time, 0.2 - 0.5 * time, 0.9 - 0.4 * time}} ;
+        } ;
+        const double duration = 2.f ;
+        const sdr::Pose reference = sdr::reference_pose(steep_twist, duration, 400000) ;
+        for(std::size_t i = 0 ; i < orders.size() ; ++i)
+        {
+            auto errors = [&](const std::size_t entries) -> std::pair<double, double> {
+                const sdr::Pose pose = sdr::run_log(steep_twist, duration, entries, orders[i].second, 1).first ;
+                return {(pose.position() - reference.position()).norm(), pose.orientation().angularDistance(reference.orientation())} ;
+            } ;
+            const auto [position_coarse, orientation_coarse] = errors(8) ;
+            const auto [position_fine, orientation_fine] = errors(16) ;
+            const double position_order = std::log2(position_coarse / position_fine) ;
+            const double orientation_order = std::log2(orientation_coarse / orientation_fine) ;
+
+            check(orders[i].first + " position converges at order " + std::to_string(static_cast<int>(expected_orders[i])) + " (observed " + std::to_string(position_order) + ")", position_order > expected_orders[i] - 0.3) ;
+            check(orders[i].first + " orientation converges at order " + std::to_string(static_cast<int>(expected_orders[i])) + " (observed " + std::to_string(orientation_order) + ")", orientation_order > expected_orders[i] - 0.3) ;
+        }
+
+        /* Constant twist - closed form is a screw motion: orientation exp(w t), position V(w t) v t */
+        const Eigen::Vector3d linear(1.f, 0.2, -0.1), angular(0.3, -0.2, 1.1) ;
+        const sdr::twist_t constant{{linear.x(), linear.y(), linear.z(), angular.x(), angular.y(), angular.z()}} ;
+        const Eigen::Vector3d phi = angular * duration ;
+        const double angle = phi.norm() ;
+        const Eigen::Matrix3d phi_hat{
+            {0.f, -phi.z(), phi.y()},
+            {phi.z(), 0.f, -phi.x()},
+            {-phi.y(), phi.x(), 0.f}
+        } ;
+        const Eigen::Matrix3d left_jacobian = Eigen::Matrix3d::Identity() + (1.f - std::cos(angle)) / (angle * angle) * phi_hat + (angle - std::sin(angle)) / (angle * angle * angle) * phi_hat * phi_hat ;
+        const sdr::position_t closed_position = (left_jacobian * linear * duration).transpose() ;
+        const sdr::quaternion_t closed_orientation{Eigen::AngleAxisd(angle, phi / angle)} ;
+
+        const std::array<std::pair<std::string, sdr::integrator_t>, 5> integrators{{
+            orders[0], orders[1], orders[2], orders[3], {"adaptive", sdr::integrator_t::adaptive}
+        }} ;
+        const std::array<double, 5> position_tolerances{0.2, 4e-3, 4e-3, 5e-7, 4e-3} ; // 20 entries
+        for(std::size_t i = 0 ; i < integrators.size() ; ++i)
+        {
+            sdr::Pose pose ;
+            for(std::size_t j = 0 ; j < 20 ; ++j)
+            {
+                pose.integrate(constant, constant, duration / 20.f, integrators[i].second) ;
+            }
+            check(integrators[i].first + " reaches closed form orientation under constant twist", pose.orientation().angularDistance(closed_orientation) < 1e-12) ;
+            check(integrators[i].first + " reaches closed form position under constant twist", (pose.position() - closed_position).norm() < position_tolerances[i]) ;
+        }
+
+        /* Adaptive with a single substep is midpoint */
+        sdr::Pose midpoint, adaptive ;
+        midpoint.integrate(steep_twist(0.f), steep_twist(1.f), 1.f, sdr::integrator_t::midpoint) ;
+        adaptive.integrate(steep_twist(0.f), steep_twist(1.f), 1.f, sdr::integrator_t::adaptive, 0.05, 1) ;
+        check("adaptive with a single substep equals midpoint", midpoint.position() == adaptive.position() && midpoint.orientation().coeffs() == adaptive.orientation().coeffs()) ;
+
+        /* Adaptive substepping at a coarse log rate (8 entries, up to ~0.3 rad each) should beat a single midpoint step per entry */
+        const sdr::Pose midpoint_log = sdr::run_log(steep_twist, duration, 8, sdr::integrator_t::midpoint, 1).first ;
+        const sdr::Pose adaptive_log = sdr::run_log(steep_twist, duration, 8, sdr::integrator_t::adaptive, 1).first ;
+        const double midpoint_error = (midpoint_log.position() - reference.position()).norm() ;
+        const double adaptive_error = (adaptive_log.position() - reference.position()).norm() ;
+        check("adaptive substeps beat midpoint at a coarse log rate (position error " + std::to_string(adaptive_error) + " vs " + std::to_string(midpoint_error) + ")", adaptive_error < 0.1 * midpoint_error) ;
+
+        /* Error handling */
+        bool names_valid = true ;
+        for(const auto& [name, integrator] : integrators)
+        {
+            names_valid = names_valid && sdr::to_integrator(name) == integrator ;
+        }
+        check("to_integrator converts valid names", names_valid) ;
+        check("to_integrator throws on invalid name", throws([]() { sdr::to_integrator("rk5") ; })) ;
+        check("integrate throws on negative time", throws([&]() { sdr::Pose().integrate(constant, constant, -1.f, sdr::integrator_t::euler) ; })) ;
+        check("integrate throws on non-positive max substep angle", throws([&]() { sdr::Pose().integrate(constant, constant, 1.f, sdr::integrator_t::adaptive, 0.f) ; })) ;
+        check("integrate throws on zero max substeps", throws([&]() { sdr::Pose().integrate(constant, constant, 1.f, sdr::integrator_t::adaptive, 0.05, 0) ; })) ;
+
+        return passed ;
+    }
+
+} ; // namespace sdr
+
+int main(int argc, char** argv)
+{
+    if(argc > 1 && std::string(argv[1]) == "--check")
+    {
+        return sdr::self_check() ? EXIT_SUCCESS : EXIT_FAILURE ;
+    }
+
+    const double duration = 20.f ; // seconds
+    const std::size_t reference_steps = 2000000 ;
+    const std::size_t repetitions = 9 ;
+    const std::array<std::size_t, 6> log_rates{1000, 200, 100, 50, 20, 10} ; // Hz
+    const std::array<std::pair<std::string, sdr::integrator_t>, 5> integrators{{
+        {"euler", sdr::integrator_t::euler},
+        {"midpoint", sdr::integrator_t::midpoint},
+        {"trapezoidal", sdr::integrator_t::trapezoidal},
+        {"rk4", sdr::integrator_t::rk4},
+        {"adaptive", sdr::integrator_t::adaptive}
+    }} ;
+    const std::array<std::pair<std::string, sdr::twist_function_t>, 2> cases{{
+        {"linear twist (interpolation exact)", sdr::linear_twist},
+        {"smooth twist", sdr::smooth_twist}
+    }} ;
+
+    for(const auto& [case_name, twist_at] : cases)
+    {
+        const sdr::Pose reference = sdr::reference_pose(twist_at, duration, reference_steps) ;
+        std::cout << case_name << ", reference (product of " << reference_steps << " exponentials):\n\t" << reference << "\n\n" ;
+
+        std::cout << std::left << std::setw(14) << "integrator" << std::setw(10) << "rate (Hz)" << std::setw(14) << "ns/entry"
+                  << std::setw(18) << "position err (m)" << "orientation err (rad)" << '\n' ;
+        for(const auto& [name, integrator] : integrators)
+        {
+            for(const std::size_t rate : log_rates)
+            {
+                const auto [pose, ns_per_entry] = sdr::run_log(twist_at, duration, static_cast<std::size_t>(duration) * rate, integrator, repetitions) ;
+                const double position_error = (pose.position() - reference.position()).norm() ;
+                const double orientation_error = pose.orientation().angularDistance(reference.orientation()) ;
+
+                std::ostringstream row ; // formatted locally so std::cout keeps its own precision for printing poses
+                row << std::left << std::setw(14) << name << std::setw(10) << rate << std::setw(14) << std::fixed << std::setprecision(1) << ns_per_entry
+                    << std::setw(18) << std::scientific << std::setprecision(3) << position_error << orientation_error ;
+                std::cout << row.str() << '\n' ;
+            }
+        }
+        std::cout << '\n' ;
+    }
+
+    return 0 ;
+}
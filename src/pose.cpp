@@ -1,6 +1,8 @@
 #include <cmath>
+#include <algorithm>
 #include <string>
 #include <cstddef>
+#include <vector>
 
 #include <Eigen/Geometry>
 
@@ -82,6 +84,118 @@ void sdr::Pose::update_orientation(const double yaw, const double pitch, const d
     this->_orientation *= delta_orientation ;
 }
 
+void sdr::Pose::integrate(const sdr::twist_t& twist_start, const sdr::twist_t& twist_end, const double time, const sdr::integrator_t integrator, const double max_substep_angle, const std::size_t max_substeps) noexcept(false)
+{
+    if(time < 0.f)
+    {
+        const std::string msg{ "Time spanned must not be negative. Value provided: " + std::to_string(time) } ;
+        throw sdr::DetailedException(__func__, __LINE__, msg) ;
+    }
+    if(integrator == sdr::integrator_t::adaptive && (!(max_substep_angle > 0.f) || max_substeps < 1))
+    {
+        const std::string msg{ "Adaptive integrator requires a positive max substep angle and at least one substep. Values provided: " + std::to_string(max_substep_angle) + ", " + std::to_string(max_substeps) } ;
+        throw sdr::DetailedException(__func__, __LINE__, msg) ;
+    }
+
+    using vector_t = Eigen::Matrix<double, 3, 1> ;
+
+    // twist at given fraction of the span (0 - start, 1 - end), linearly interpolated
+    auto linear_at = [&](const double s) -> vector_t {
+        return ((1.f - s) * twist_start.head<3>() + s * twist_end.head<3>()).transpose() ;
+    } ;
+    auto angular_at = [&](const double s) -> vector_t {
+        return ((1.f - s) * twist_start.tail<3>() + s * twist_end.tail<3>()).transpose() ;
+    } ;
+
+    // SO(3) exponential map - rotation vector to rotation matrix
+    auto exp_so3 = [](const vector_t& theta) -> sdr::rotation_m_t {
+        const double angle = theta.norm() ;
+        if(angle < 1e-12)
+        {
+            return sdr::rotation_m_t::Identity() ;
+        }
+        return Eigen::AngleAxis<double>(angle, theta / angle).toRotationMatrix() ;
+    } ;
+
+    // inverse of the SO(3) exponential map's (right trivialised) differential, as orientation is composed in the local frame - truncated past the terms required for fourth order accuracy
+    auto dexp_inv = [](const vector_t& theta, const vector_t& omega) -> vector_t {
+        return omega + 0.5 * theta.cross(omega) + (1.0 / 12.0) * theta.cross(theta.cross(omega)) ;
+    } ;
+
+    // single step from fraction s of the span, covering fraction h of it. State is kept as a rotation vector relative to the orientation at the step's start (theta) alongside the global translation accumulated throughout the step (delta)
+    auto step = [&](const double s, const double h, const sdr::integrator_t scheme) -> void {
+        const sdr::rotation_m_t initial_orientation = this->_orientation ;
+        const double dt = h * time ;
+
+        auto theta_rate = [&](const double at, const vector_t& theta) -> vector_t {
+            return dexp_inv(theta, angular_at(at)) ;
+        } ;
+        auto delta_rate = [&](const double at, const vector_t& theta) -> vector_t {
+            return initial_orientation * exp_so3(theta) * linear_at(at) ;
+        } ;
+
+        vector_t theta = vector_t::Zero(), delta = vector_t::Zero() ;
+        switch(scheme)
+        {
+            case sdr::integrator_t::euler:
+            {
+                // zero order hold on latest twist, translation applied before orientation changes
+                delta = dt * (initial_orientation * linear_at(1.f)) ;
+                theta = dt * angular_at(1.f) ;
+                break ;
+            }
+            case sdr::integrator_t::midpoint:
+            case sdr::integrator_t::adaptive:
+            {
+                const vector_t theta_half = 0.5 * dt * theta_rate(s, vector_t::Zero()) ;
+                theta = dt * theta_rate(s + 0.5 * h, theta_half) ;
+                delta = dt * delta_rate(s + 0.5 * h, theta_half) ;
+                break ;
+            }
+            case sdr::integrator_t::trapezoidal:
+            {
+                const vector_t k1_theta = theta_rate(s, vector_t::Zero()) ;
+                const vector_t k1_delta = delta_rate(s, vector_t::Zero()) ;
+                const vector_t theta_end = dt * k1_theta ;
+                theta = 0.5 * dt * (k1_theta + theta_rate(s + h, theta_end)) ;
+                delta = 0.5 * dt * (k1_delta + delta_rate(s + h, theta_end)) ;
+                break ;
+            }
+            case sdr::integrator_t::rk4:
+            {
+                const vector_t k1_theta = theta_rate(s, vector_t::Zero()) ;
+                const vector_t k1_delta = delta_rate(s, vector_t::Zero()) ;
+                const vector_t k2_theta = theta_rate(s + 0.5 * h, 0.5 * dt * k1_theta) ;
+                const vector_t k2_delta = delta_rate(s + 0.5 * h, 0.5 * dt * k1_theta) ;
+                const vector_t k3_theta = theta_rate(s + 0.5 * h, 0.5 * dt * k2_theta) ;
+                const vector_t k3_delta = delta_rate(s + 0.5 * h, 0.5 * dt * k2_theta) ;
+                const vector_t k4_theta = theta_rate(s + h, dt * k3_theta) ;
+                const vector_t k4_delta = delta_rate(s + h, dt * k3_theta) ;
+                theta = (dt / 6.0) * (k1_theta + 2.0 * k2_theta + 2.0 * k3_theta + k4_theta) ;
+                delta = (dt / 6.0) * (k1_delta + 2.0 * k2_delta + 2.0 * k3_delta + k4_delta) ;
+                break ;
+            }
+        }
+
+        this->_position += delta.transpose() ;
+        this->_orientation = initial_orientation * exp_so3(theta) ;
+    } ;
+
+    if(integrator != sdr::integrator_t::adaptive)
+    {
+        step(0.f, 1.f, integrator) ;
+        return ;
+    }
+
+    // substep so no single substep rotates beyond the given max angle
+    const double max_angle = std::max(twist_start.tail<3>().norm(), twist_end.tail<3>().norm()) * time ;
+    const std::size_t substeps = std::clamp(static_cast<std::size_t>(std::ceil(max_angle / max_substep_angle)), static_cast<std::size_t>(1), max_substeps) ;
+    for(std::size_t i = 0 ; i < substeps ; ++i)
+    {
+        step(static_cast<double>(i) / substeps, 1.0 / substeps, integrator) ;
+    }
+}
+
 std::vector<double> sdr::velocities_to_deltas(const std::vector<double>& velocities, const double time) noexcept
 {
     std::vector<double> deltas(velocities.size()) ;
@@ -94,6 +208,23 @@ std::vector<double> sdr::velocities_to_deltas(const std::vector<double>& velocit
     return deltas ;
 }
 
+sdr::integrator_t sdr::to_integrator(const std::string& name) noexcept(false)
+{
+    if(name == "euler")
+        return sdr::integrator_t::euler ;
+    else if(name == "midpoint")
+        return sdr::integrator_t::midpoint ;
+    else if(name == "trapezoidal")
+        return sdr::integrator_t::trapezoidal ;
+    else if(name == "rk4")
+        return sdr::integrator_t::rk4 ;
+    else if(name == "adaptive")
+        return sdr::integrator_t::adaptive ;
+
+    const std::string msg{ "'" + name + "' is not a valid integrator (euler, midpoint, trapezoidal, rk4, adaptive)" } ;
+    throw sdr::DetailedException(__func__, __LINE__, msg) ;
+}
+
 std::ostream& sdr::operator<<(::std::ostream& os, const sdr::Pose& pose) noexcept
 {
     os << "Position: " << pose._position << ". Orientation: " << pose.orientation() ;
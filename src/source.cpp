@@ -5,6 +5,8 @@
 #include <tuple>
 #include <vector>
 #include <array>
+#include <optional>
+#include <string>
 
 #include <argp.h>
 
@@ -25,12 +27,16 @@
     const char* argp_program_bug_address = "salih.msa@outlook.com" ;
     static struct argp_option options[] = {
         {"initial_pose", 'p', "YAML_FILE", 0, "Reads an initial YAML file containing initial position & orientation in a world"},
+        {"integrator", 'i', "METHOD", 0, "Integrates each entry with given scheme (euler, midpoint, trapezoidal, rk4, adaptive) rather than applying deltas directly"},
+        {"max_substep_angle", 'a', "RADIANS", 0, "Max rotation in radians per substep of the adaptive integrator (default 0.01)"},
         {0}
     } ;
     struct arguments {
         /** @brief struct arguments - this structure is used to communicate with parse_opt (for it to store the values it parses within it) **/
         char* args[3] ;  /* args for params */
         char* initial_pose_file ;
+        char* integrator ;
+        char* max_substep_angle ;
     } ;
 
 
@@ -48,6 +54,12 @@
             case 'p':
                 arguments->initial_pose_file = arg ;
                 break ;
+            case 'i':
+                arguments->integrator = arg ;
+                break ;
+            case 'a':
+                arguments->max_substep_angle = arg ;
+                break ;
             case ARGP_KEY_ARG:
                 if(state->arg_num >= 3)
                 {
@@ -119,6 +131,8 @@ int main(int argc, char** argv)
     /* Initialisation */
     struct arguments arguments ;
     arguments.initial_pose_file = nullptr ;
+    arguments.integrator = nullptr ;
+    arguments.max_substep_angle = nullptr ;
     static struct argp argp = { // argp - The ARGP structure itself
         options, // options
         parse_opt, // callback function to process args
@@ -148,6 +162,19 @@ int main(int argc, char** argv)
     }
     std::cout << "Starting:\n\t" << pose << std::endl ;
 
+    std::optional<sdr::integrator_t> integrator ; // applies deltas directly (first order) if not specified
+    if(arguments.integrator)
+    {
+        integrator = sdr::to_integrator(std::string(arguments.integrator)) ;
+    }
+    const double max_substep_angle = arguments.max_substep_angle ? std::atof(arguments.max_substep_angle) : sdr::default_max_substep_angle ;
+    if(!(max_substep_angle > 0.f))
+    {
+        const std::string msg = "'" + std::to_string(max_substep_angle) + "' provided as the max substep angle - should be a positive non-zero number of radians" ;
+        throw sdr::DetailedException(__func__, static_cast<unsigned int>(__LINE__), msg) ;
+    }
+    std::optional<sdr::twist_t> previous_twist ; // twist reported by previous entry, used as start of span when integrating
+
     /* Main functionality */
     auto at_end = [&]() -> bool
     {
@@ -165,6 +192,18 @@ int main(int argc, char** argv)
         /* Read in velocity values along each axis as well as time spent in said velocities */
         const auto [linear_vels_x, linear_vels_y, linear_vels_z, angular_vels_x, angular_vels_y, angular_vels_z, time] = sdr::read_log_entry(input, static_cast<std::size_t>(number_of_sources)) ;
 
+        if(integrator)
+        {
+            /* Integrate twist over time span, interpolating from previous entry */
+            const sdr::twist_t twist{
+                {linear_vels_x[0], linear_vels_y[0], linear_vels_z[0], angular_vels_x[0], angular_vels_y[0], angular_vels_z[0]}
+            } ;
+            pose.integrate(previous_twist.value_or(twist), twist, time, *integrator, max_substep_angle) ;
+            previous_twist = twist ;
+            std::cout << pose << std::endl ;
+            continue ;
+        }
+
         /* Process preliminary input */
         const auto deltas_x = sdr::velocities_to_deltas(linear_vels_x, time) ;
         const auto deltas_y = sdr::velocities_to_deltas(linear_vels_y, time) ;